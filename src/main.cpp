@@ -7,9 +7,22 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <cmath>
+#include <algorithm>
+#include <random>
+#include <climits>
+#include <stdexcept>
+
+#ifdef _WIN32
+    #define NOMINMAX
+    #include <windows.h>
+    #include <psapi.h>
+#endif
 
 using namespace std;
 #define MAX_THREADS 4
+#define WEIGHT_GRID_SCALE 10.0
+#define WEIGHT_GRID_EPSILON 1e-3
 
 
 /*
@@ -28,13 +41,98 @@ struct Item
 // Postconditions:
 //   1.) Holds Input Size n As Unsigned Integer
 //   2.) Holds Runtime As Float Value
-//   3.) Members Are Publicly Accessible
+//   3.) Holds Peak Resident Set Size Growth Of The Run In Kilobytes (0 If Not Recorded)
+//   4.) Members Are Publicly Accessible
 struct BenchmarkResult
 {
     unsigned int n;
     float runtime;
+    unsigned long peakRSS = 0;
 };
 
+
+#ifndef _WIN32
+// Preconditions:
+//   1.) key Is A /proc/self/status Field Name Including Its Colon
+// Postconditions:
+//   1.) Returns The Field's Value In Kilobytes, Or 0 If /proc Isn't Available
+unsigned long readProcStatusKB(const std::string& key)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, key.size(), key) == 0)
+        {
+            return std::stoul(line.substr(key.size()));
+        }
+    }
+    return 0;
+}
+#endif
+
+// Postconditions:
+//   1.) Returns Current Resident Set Size Of The Process In Kilobytes
+//   2.) Returns 0 If The Platform Doesn't Expose It
+unsigned long getCurrentRSS()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return static_cast<unsigned long>(counters.WorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    return readProcStatusKB("VmRSS:");
+#endif
+}
+
+// Postconditions:
+//   1.) Returns Peak Resident Set Size Of The Process In Kilobytes
+//   2.) Returns 0 Without /proc Or Windows (e.g. macOS), Where The Peak Can't Be Reset Per Run
+unsigned long getPeakRSS()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return static_cast<unsigned long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    // VmHWM Honours resetPeakRSS()
+    return readProcStatusKB("VmHWM:");
+#endif
+}
+
+// Postconditions:
+//   1.) Peak Resident Set Size Is Reset To Current Resident Set Size Where Supported (Linux)
+//   2.) Silently Does Nothing Elsewhere
+void resetPeakRSS()
+{
+#ifndef _WIN32
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs)
+    {
+        clearRefs << "5";
+    }
+#endif
+}
+
+// Preconditions:
+//   1.) baseline Was Taken With getCurrentRSS() Right After resetPeakRSS()
+//   2.) No Other Thread Allocates Until This Is Called
+// Postconditions:
+//   1.) Returns How Far Peak Resident Set Size Rose Above baseline In Kilobytes
+//   2.) Where The Peak Can't Be Reset (Windows) This Only Holds If The Run Set A New Lifetime Peak
+//   3.) Returns 0 Where getPeakRSS() Isn't Supported
+unsigned long getPeakRSSAbove(const unsigned long baseline)
+{
+    const unsigned long peak = getPeakRSS();
+    return peak > baseline ? peak - baseline : 0;
+}
+
 // Postconditions:
 //   1.) Provides Thread-Safe Queue Operations
 //   2.) Maintains FIFO Order Of Tasks
@@ -161,6 +259,310 @@ float knapSackHeuristic(Item items[], float capacity, unsigned int n, std::vecto
     return maxProfit;
 }
 
+
+// Preconditions:
+//   1.) units Is A Whole Number Of Grid Units
+// Postconditions:
+//   1.) Returns units As An unsigned int With Room Left For capacity + 1
+//   2.) Throws std::invalid_argument If units Is Negative Or Too Large
+unsigned int checkedGridUnits(const double units, const std::string& what)
+{
+    if (units < 0.0 || units >= static_cast<double>(UINT_MAX))
+    {
+        throw std::invalid_argument(what + " Of " + std::to_string(units / WEIGHT_GRID_SCALE) +
+                                    " Doesn't Fit The Weight Grid");
+    }
+    return static_cast<unsigned int>(units);
+}
+
+// Preconditions:
+//   1.) weight Is Non-Negative
+// Postconditions:
+//   1.) Returns weight In 1 / WEIGHT_GRID_SCALE Units, Rounded Up So Off-Grid Weights Never Undercount
+//   2.) Throws std::invalid_argument If It Doesn't Fit An unsigned int
+unsigned int weightToGridUnits(const float weight)
+{
+    return checkedGridUnits(std::ceil(weight * WEIGHT_GRID_SCALE - WEIGHT_GRID_EPSILON), "Weight");
+}
+
+// Preconditions:
+//   1.) capacity Is Non-Negative
+// Postconditions:
+//   1.) Returns capacity In 1 / WEIGHT_GRID_SCALE Units, Rounded Down So Bins Never Overflow
+//   2.) Throws std::invalid_argument If It Doesn't Fit An unsigned int
+unsigned int capacityToGridUnits(const float capacity)
+{
+    return checkedGridUnits(std::floor(capacity * WEIGHT_GRID_SCALE + WEIGHT_GRID_EPSILON), "Capacity");
+}
+
+// Preconditions:
+//   1.) weights Holds Scaled Integer Weight Of Each Item In [lo, hi)
+//   2.) profile Has Room For capacity + 1 Entries
+// Postconditions:
+//   1.) profile[c] Holds Maximum Profit Of Items [lo, hi) Fitting In c For Every c <= capacity
+//   2.) Profits Are Summed In double As float Stops Holding Every Integer Past 2^24
+void knapSackProfile(const Item items[], const std::vector<unsigned int>& weights, const unsigned int lo, const unsigned int hi,
+                     const unsigned int capacity, std::vector<double>& profile)
+{
+    std::fill(profile.begin(), profile.begin() + capacity + 1, 0.0);
+
+    for (unsigned int i = lo; i < hi; i++)
+    {
+        if (weights[i] > capacity)
+        {
+            continue;
+        }
+
+        // Walk Capacities Downward So Each Item Is Only Counted Once
+        for (unsigned int c = capacity + 1; c-- > weights[i];)
+        {
+            profile[c] = std::max(profile[c], profile[c - weights[i]] + items[i].profit);
+        }
+    }
+}
+
+// Preconditions:
+//   1.) front And back Have Room For capacity + 1 Entries
+//   2.) lo < hi
+// Postconditions:
+//   1.) bin Has Optimal Items Of [lo, hi) Fitting In capacity Appended In Index Order
+//   2.) front And back Contents Are Overwritten
+void knapSackDPRecover(Item items[], const std::vector<unsigned int>& weights, const unsigned int lo, const unsigned int hi,
+                       const unsigned int capacity, std::vector<double>& front, std::vector<double>& back, std::vector<Item*>& bin)
+{
+    // Single Item Left, Take It If It Fits
+    if (hi - lo == 1)
+    {
+        if (weights[lo] <= capacity && items[lo].profit > 0.0f)
+        {
+            bin.push_back(&items[lo]);
+        }
+        return;
+    }
+
+    // Build Profiles Of Both Halves Then Find Where The Optimal Solution Splits capacity
+    const unsigned int mid = lo + (hi - lo) / 2;
+    knapSackProfile(items, weights, lo, mid, capacity, front);
+    knapSackProfile(items, weights, mid, hi, capacity, back);
+
+    unsigned int split = 0;
+    double best = -1.0;
+    for (unsigned int c = 0; c <= capacity; c++)
+    {
+        if (front[c] + back[capacity - c] > best)
+        {
+            best = front[c] + back[capacity - c];
+            split = c;
+        }
+    }
+
+    // Profiles Are No Longer Needed So Both Halves Can Reuse The Same Buffers
+    knapSackDPRecover(items, weights, lo, mid, split, front, back, bin);
+    knapSackDPRecover(items, weights, mid, hi, capacity - split, front, back, bin);
+}
+
+// Preconditions:
+//   1.) Valid Array Of Items With Size n
+//   2.) Capacity Must Be Non-Negative Float
+//   3.) n Must Be Non-Negative Integer
+//   4.) bin Vector Must Be Empty & Is Bin To Fill
+// Postconditions:
+//   1.) Returns Maximum Profit Achievable With Given capacity On The Weight Grid, Where Weights
+//       Round Up And capacity Rounds Down, So Off-Grid Weights May Cost Profit But Never Overflow
+//   2.) bin Contains Selected Items For Maximum Profit In Index Order
+//   3.) Original Items Array Remains Unchanged
+//   4.) Uses O(capacity) Memory Beyond The Items By Recovering Items Hirschberg-Style
+//   5.) Zero-Weight Items Are Still Taken When capacity Is 0
+//   6.) Throws std::invalid_argument If A Weight Or capacity Doesn't Fit The Grid
+float knapSackDP(Item items[], const float capacity, const unsigned int n, std::vector<Item*>& bin)
+{
+    if (n == 0 || capacity < 0.0f)
+    {
+        return 0.0f;
+    }
+
+    // Scale Float Weights Onto An Integer Capacity Grid
+    const unsigned int scaledCapacity = capacityToGridUnits(capacity);
+    std::vector<unsigned int> weights(n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        weights[i] = weightToGridUnits(items[i].weight);
+    }
+
+    std::vector<double> front(scaledCapacity + 1), back(scaledCapacity + 1);
+    knapSackDPRecover(items, weights, 0, n, scaledCapacity, front, back, bin);
+
+    double maxProfit = 0.0;
+    for (const auto& item : bin)
+    {
+        maxProfit += item->profit;
+    }
+
+    return static_cast<float>(maxProfit);
+}
+
+// Postconditions:
+//   1.) Holds Best Profit And Subset Mask Found By One Gray-Code Worker
+//   2.) profit Is Negative If No Subset Of The Worker's Range Fits
+struct GrayBest
+{
+    double profit = -1.0;
+    unsigned long long mask = 0;
+};
+
+// Preconditions:
+//   1.) x Must Be Non-Zero
+// Postconditions:
+//   1.) Returns Index Of Lowest Set Bit Of x
+inline unsigned int countTrailingZeros(unsigned long long x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned int>(__builtin_ctzll(x));
+#else
+    unsigned int count = 0;
+    while ((x & 1ULL) == 0)
+    {
+        x >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+// Preconditions:
+//   1.) weights And profits Hold n Entries With Weights In Grid Units
+//   2.) lowBits <= n And prefix < 2^(n - lowBits)
+// Postconditions:
+//   1.) best Holds The Most Profitable Fitting Subset Whose High Bits Equal prefix
+//   2.) Each Step Of The Walk Adds Or Subtracts A Single Item
+void knapSackGrayWorker(const std::vector<long long>& weights, const std::vector<double>& profits, const unsigned int n,
+                        const unsigned int lowBits, const unsigned long long prefix, const long long capacity, GrayBest& best)
+{
+    // Start From The Fixed High Bits With All Low Bits Cleared
+    unsigned long long mask = prefix << lowBits;
+    long long weight = 0;
+    double profit = 0.0;
+    for (unsigned int j = lowBits; j < n; j++)
+    {
+        if ((mask >> j) & 1ULL)
+        {
+            weight += weights[j];
+            profit += profits[j];
+        }
+    }
+
+    // Keep The Running Best In Locals So Workers Never Touch Shared Memory In The Loop
+    double bestProfit = -1.0;
+    unsigned long long bestMask = 0;
+    if (weight <= capacity)
+    {
+        bestProfit = profit;
+        bestMask = mask;
+    }
+
+    // Step i Of A Gray Code Flips Bit ctz(i), So Consecutive Subsets Differ By One Item
+    const unsigned long long steps = 1ULL << lowBits;
+    for (unsigned long long i = 1; i < steps; i++)
+    {
+        const unsigned int bit = countTrailingZeros(i);
+        const unsigned long long flag = 1ULL << bit;
+        mask ^= flag;
+
+        // Bit Now Set Means The Item Went In, Otherwise It Came Out
+        const bool added = (mask & flag) != 0;
+        weight += added ? weights[bit] : -weights[bit];
+        profit += added ? profits[bit] : -profits[bit];
+
+        if (weight <= capacity && profit > bestProfit)
+        {
+            bestProfit = profit;
+            bestMask = mask;
+        }
+    }
+
+    best.profit = bestProfit;
+    best.mask = bestMask;
+}
+
+// Preconditions:
+//   1.) Valid Array Of Items With Size n And Non-Negative Weights
+//   2.) Capacity Must Be Non-Negative Float
+//   3.) bin Vector Must Be Empty & Is Bin To Fill
+// Postconditions:
+//   1.) Returns Maximum Profit Achievable With Given capacity On The Same Weight Grid As knapSackDP()
+//   2.) bin Contains Selected Items For Maximum Profit In Index Order
+//   3.) Original Items Array Remains Unchanged
+//   4.) All 2^n Subsets Are Checked, Split Across Up To MAX_THREADS Threads
+//   5.) Zero-Weight Items Are Still Taken When capacity Is 0
+//   6.) Throws std::invalid_argument If n >= 64 Or A Weight Or capacity Doesn't Fit The Grid
+float knapSackGray(Item items[], const float capacity, const unsigned int n, std::vector<Item*>& bin)
+{
+    if (n >= 64)
+    {
+        throw std::invalid_argument("knapSackGray: n = " + std::to_string(n) + " Needs More Than 63 Mask Bits");
+    }
+
+    if (n == 0 || capacity < 0.0f)
+    {
+        return 0.0f;
+    }
+
+    // Grid Units Keep Billions Of Add/Subtract Steps Exact And Match knapSackDP()'s Capacity Rule
+    const long long scaledCapacity = capacityToGridUnits(capacity);
+    std::vector<long long> weights(n);
+    std::vector<double> profits(n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        weights[i] = weightToGridUnits(items[i].weight);
+        profits[i] = items[i].profit;
+    }
+
+    // Fix The Top highBits Of The Mask Per Thread, Each Thread Walks The Rest In Gray Order
+    unsigned int highBits = 0;
+    while ((2u << highBits) <= MAX_THREADS && highBits < n)
+    {
+        highBits++;
+    }
+    const unsigned int lowBits = n - highBits;
+    const unsigned int chunks = 1u << highBits;
+
+    std::vector<GrayBest> bests(chunks);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < chunks; t++)
+    {
+        threads.emplace_back(knapSackGrayWorker, std::cref(weights), std::cref(profits), n, lowBits,
+                             static_cast<unsigned long long>(t), scaledCapacity, std::ref(bests[t]));
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Reduce Per-Thread Bests
+    GrayBest best;
+    for (const auto& candidate : bests)
+    {
+        if (candidate.profit > best.profit)
+        {
+            best = candidate;
+        }
+    }
+
+    // Re-Sum Profit From The Items So Drift In The Running Total Doesn't Leak Out
+    float maxProfit = 0.0f;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if ((best.mask >> i) & 1ULL)
+        {
+            bin.push_back(&items[i]);
+            maxProfit += items[i].profit;
+        }
+    }
+
+    return maxProfit;
+}
+
 // Postconditions:
 //   1.) Executes All Unit Tests For Exact Algorithm
 //   2.) Displays Results For Each Test Case
@@ -503,13 +905,254 @@ void testUnitHeuristic() {
 
 }
 
+// Preconditions:
+//   1.) bin Holds The Items A Solver Returned Along With profit
+// Postconditions:
+//   1.) Returns True If bin Fits In capacity And Its Profits Sum To profit
+bool checkBin(const std::vector<Item*>& bin, const float capacity, const float profit)
+{
+    double weight = 0.0, binProfit = 0.0;
+    for (const auto& item : bin)
+    {
+        weight += item->weight;
+        binProfit += item->profit;
+    }
+    return weight <= capacity && std::fabs(binProfit - profit) < 1e-3;
+}
+
+// Preconditions:
+//   1.) bin Holds The Items A Grid-Based Solver Returned Along With profit
+// Postconditions:
+//   1.) Returns True If bin Fits In capacity On The Weight Grid And Its Profits Sum To profit
+bool checkGridBin(const std::vector<Item*>& bin, const float capacity, const float profit)
+{
+    unsigned long long weight = 0;
+    double binProfit = 0.0;
+    for (const auto& item : bin)
+    {
+        weight += weightToGridUnits(item->weight);
+        binProfit += item->profit;
+    }
+    return weight <= capacityToGridUnits(capacity) && std::fabs(binProfit - profit) < 1e-3;
+}
+
+// Postconditions:
+//   1.) Cross-Checks Linear-Memory DP And Gray-Code Algorithms Against Exact Algorithm And Each Other On Seeded Random 0.5 And 0.1 Grids
+//   2.) Checks Hirschberg Splits That Hand A Half A capacity Of 0, Off-Grid Weights, And Out-Of-Range capacity
+//   3.) Checks Gray-Code n Below The Thread Split And Rejection Of n >= 64
+//   4.) Returns True If Every Check Passed, Printing Each Failure
+bool testUnitExact()
+{
+    std::cout << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~START EXACT CROSS-CHECK~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+    unsigned int failures = 0;
+
+    // Weights On A 0.5 Grid Keep knapSack()'s Float Subtraction Exact And Sit On The Weight Grid
+    std::mt19937 generator(2024);
+    for (unsigned int trial = 0; trial < 500; trial++)
+    {
+        const unsigned int n = 1 + generator() % 14;
+        std::vector<Item> items(n);
+        for (auto& item : items)
+        {
+            item.weight = static_cast<float>(1 + generator() % 16) * 0.5f;
+            item.profit = static_cast<float>(1 + generator() % 100);
+        }
+        const float capacity = static_cast<float>(generator() % 40) * 0.5f;
+
+        std::vector<Item*> exactBin, dpBin, grayBin;
+        const float exactProfit = knapSack(items.data(), capacity, n, exactBin);
+        const float dpProfit = knapSackDP(items.data(), capacity, n, dpBin);
+        const float grayProfit = knapSackGray(items.data(), capacity, n, grayBin);
+
+        if (exactProfit != dpProfit || exactProfit != grayProfit ||
+            !checkGridBin(dpBin, capacity, dpProfit) || !checkGridBin(grayBin, capacity, grayProfit))
+        {
+            std::cout << "  FAIL: Trial " << trial << " (n = " << n << ", capacity = " << capacity << ") knapSack = $"
+                      << exactProfit << ", knapSackDP = $" << dpProfit << ", knapSackGray = $" << grayProfit << "\n";
+            failures++;
+        }
+    }
+
+    // On A 0.1 Grid knapSack()'s Float Subtraction Can Miss Exact Fits, So It May Only Fall Short
+    for (unsigned int trial = 0; trial < 500; trial++)
+    {
+        const unsigned int n = 1 + generator() % 14;
+        std::vector<Item> items(n);
+        for (auto& item : items)
+        {
+            item.weight = static_cast<float>(1 + generator() % 40) * 0.1f;
+            item.profit = static_cast<float>(1 + generator() % 100);
+        }
+        const float capacity = static_cast<float>(generator() % 100) * 0.1f;
+
+        std::vector<Item*> exactBin, dpBin, grayBin;
+        const float exactProfit = knapSack(items.data(), capacity, n, exactBin);
+        const float dpProfit = knapSackDP(items.data(), capacity, n, dpBin);
+        const float grayProfit = knapSackGray(items.data(), capacity, n, grayBin);
+
+        if (dpProfit != grayProfit || exactProfit > dpProfit ||
+            !checkGridBin(dpBin, capacity, dpProfit) || !checkGridBin(grayBin, capacity, grayProfit))
+        {
+            std::cout << "  FAIL: 0.1-Grid Trial " << trial << " (n = " << n << ", capacity = " << capacity
+                      << ") knapSack = $" << exactProfit << ", knapSackDP = $" << dpProfit
+                      << ", knapSackGray = $" << grayProfit << "\n";
+            failures++;
+        }
+    }
+
+    // Zero-Weight Items Still Fit A capacity Of 0, Including Within Halves The Split Gives Nothing
+    {
+        Item items[] =
+        {
+            {0.0f, 5.0f, "Feather"},
+            {1.0f, 3.0f, "Brick"},
+            {0.0f, 2.0f, "Coupon"},
+            {2.0f, 9.0f, "Anvil"}
+        };
+        const float capacities[] = {0.0f, 1.0f, 2.0f};
+        const float expected[] = {7.0f, 10.0f, 16.0f};
+
+        for (unsigned int i = 0; i < 3; i++)
+        {
+            std::vector<Item*> dpBin, grayBin;
+            const float dpProfit = knapSackDP(items, capacities[i], 4, dpBin);
+            const float grayProfit = knapSackGray(items, capacities[i], 4, grayBin);
+            if (dpProfit != expected[i] || grayProfit != expected[i] ||
+                !checkGridBin(dpBin, capacities[i], dpProfit) || !checkGridBin(grayBin, capacities[i], grayProfit))
+            {
+                std::cout << "  FAIL: Zero-Weight capacity = " << capacities[i] << " knapSackDP = $" << dpProfit
+                          << ", knapSackGray = $" << grayProfit << ", expected $" << expected[i] << "\n";
+                failures++;
+            }
+        }
+    }
+
+    // Off-Grid Weights Round Up, So 0.14s Count As 0.2 And Only One Fits In 0.3
+    {
+        Item items[] =
+        {
+            {0.14f, 10.0f, "Pebble_A"},
+            {0.14f, 10.0f, "Pebble_B"},
+            {0.14f, 10.0f, "Pebble_C"}
+        };
+
+        std::vector<Item*> dpBin, grayBin;
+        const float dpProfit = knapSackDP(items, 0.3f, 3, dpBin);
+        const float grayProfit = knapSackGray(items, 0.3f, 3, grayBin);
+        if (dpProfit != 10.0f || grayProfit != 10.0f ||
+            !checkGridBin(dpBin, 0.3f, dpProfit) || !checkBin(dpBin, 0.3f, dpProfit) ||
+            !checkGridBin(grayBin, 0.3f, grayProfit) || !checkBin(grayBin, 0.3f, grayProfit))
+        {
+            std::cout << "  FAIL: Off-Grid Weights knapSackDP = $" << dpProfit << ", knapSackGray = $" << grayProfit
+                      << ", expected $10\n";
+            failures++;
+        }
+    }
+
+    // 0.1-Grid Weights Whose float Sums Land Just Past capacity Still Count As Fitting On The Grid
+    {
+        Item items[] =
+        {
+            {2.5f, 100.0f, "Gaming_Console"},
+            {1.0f, 50.0f, "Premium_Headphones"},
+            {3.0f, 150.0f, "Drone"},
+            {0.5f, 95.0f, "Smartwatch"},
+            {2.0f, 75.0f, "Bluetooth_Speaker"},
+            {1.5f, 80.0f, "Portable_Charger"},
+            {0.8f, 60.0f, "Wireless_Mouse"},
+            {4.0f, 200.0f, "4K_Camera"},
+            {1.2f, 70.0f, "Keyboard"},
+            {0.3f, 40.0f, "USB_Drive"}
+        };
+
+        std::vector<Item*> exactBin, dpBin, grayBin;
+        const float exactProfit = knapSack(items, 3.1f, 10, exactBin);
+        const float dpProfit = knapSackDP(items, 3.1f, 10, dpBin);
+        const float grayProfit = knapSackGray(items, 3.1f, 10, grayBin);
+        if (exactProfit != 275.0f || dpProfit != 275.0f || grayProfit != 275.0f ||
+            !checkGridBin(dpBin, 3.1f, dpProfit) || !checkGridBin(grayBin, 3.1f, grayProfit))
+        {
+            std::cout << "  FAIL: Unit-Test-1 Items At capacity 3.1 knapSack = $" << exactProfit
+                      << ", knapSackDP = $" << dpProfit << ", knapSackGray = $" << grayProfit << ", expected $275\n";
+            failures++;
+        }
+    }
+
+    // Capacities Past The unsigned int Grid Must Be Rejected Rather Than Wrap
+    {
+        Item items[] = {{1.0f, 1.0f, "Brick"}};
+        std::vector<Item*> bin;
+        bool rejected = false;
+        try
+        {
+            knapSackDP(items, 1e9f, 1, bin);
+        }
+        catch (const std::invalid_argument&)
+        {
+            rejected = true;
+        }
+
+        if (!rejected)
+        {
+            std::cout << "  FAIL: knapSackDP Accepted capacity = 1e9\n";
+            failures++;
+        }
+    }
+
+    // n = 1 Leaves Fewer Items Than The High Bits MAX_THREADS Would Fix
+    {
+        Item items[] = {{0.2f, 10.0f, "Pebble"}};
+        const float capacities[] = {0.1f, 0.2f};
+        const float expected[] = {0.0f, 10.0f};
+
+        for (unsigned int i = 0; i < 2; i++)
+        {
+            std::vector<Item*> bin;
+            const float profit = knapSackGray(items, capacities[i], 1, bin);
+            if (profit != expected[i] || !checkGridBin(bin, capacities[i], profit))
+            {
+                std::cout << "  FAIL: n = 1, capacity = " << capacities[i] << " knapSackGray = $" << profit
+                          << ", expected $" << expected[i] << "\n";
+                failures++;
+            }
+        }
+    }
+
+    // n >= 64 Doesn't Fit A Mask And Must Be Rejected Rather Than Look Like An Empty Bin
+    {
+        std::vector<Item> items(64, {1.0f, 1.0f, "Filler"});
+        std::vector<Item*> bin;
+        bool rejected = false;
+        try
+        {
+            knapSackGray(items.data(), 10.0f, 64, bin);
+        }
+        catch (const std::invalid_argument&)
+        {
+            rejected = true;
+        }
+
+        if (!rejected)
+        {
+            std::cout << "  FAIL: knapSackGray Accepted n = 64\n";
+            failures++;
+        }
+    }
+
+    std::cout << "  " << (failures == 0 ? "PASS" : "FAIL") << ": " << failures << " Failure(s)\n";
+    std::cout << "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~END EXACT CROSS-CHECK~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+    return failures == 0;
+}
+
 // Preconditions:
 //   1.) Valid Queue, Results Vector, And Mutex References
+//   2.) recordRSS Only Set When This Is The Only Worker Running
 // Postconditions:
 //   1.) Processes Benchmark Tasks For Exact Algorithm
-//   2.) Updates Results Vector With Runtime Data
+//   2.) Updates Results Vector With Runtime Data, And Peak RSS Growth If recordRSS
 //   3.) Thread-Safe Operation Maintained
-void benchmarkWorker(ThreadSafeQueue& taskQueue, std::vector<BenchmarkResult>& results, std::mutex& resultsMutex)
+void benchmarkWorker(ThreadSafeQueue& taskQueue, std::vector<BenchmarkResult>& results, std::mutex& resultsMutex,
+                     const bool recordRSS)
 {
     unsigned int n;
     while(taskQueue.pop(n))
@@ -529,14 +1172,22 @@ void benchmarkWorker(ThreadSafeQueue& taskQueue, std::vector<BenchmarkResult>& r
         std::vector<Item*> bin;
         float capacity = (float)(n) * 0.5f;
 
+        unsigned long baselineRSS = 0;
+        if (recordRSS)
+        {
+            resetPeakRSS();
+            baselineRSS = getCurrentRSS();
+        }
+
         auto start = std::chrono::high_resolution_clock::now();
         knapSack(items, capacity, n, bin);
         auto end = std::chrono::high_resolution_clock::now();
+        unsigned long peakRSS = recordRSS ? getPeakRSSAbove(baselineRSS) : 0;
 
         float runtime = std::chrono::duration<float, std::milli>(end - start).count();
         {
             std::lock_guard<std::mutex> lock(resultsMutex);
-            results.push_back({n, runtime});
+            results.push_back({n, runtime, peakRSS});
         }
 
         delete[] items;
@@ -546,11 +1197,13 @@ void benchmarkWorker(ThreadSafeQueue& taskQueue, std::vector<BenchmarkResult>& r
 
 // Preconditions:
 //   1.) Valid Queue, Results Vector, And Mutex References
+//   2.) recordRSS Only Set When This Is The Only Worker Running
 // Postconditions:
 //   1.) Processes Benchmark Tasks For Heuristic Algorithm
-//   2.) Updates Results Vector With Runtime Data
+//   2.) Updates Results Vector With Runtime Data, And Peak RSS Growth If recordRSS
 //   3.) Thread-Safe Operation Maintained
-void benchmarkWorkerHeuristic(ThreadSafeQueue& taskQueue, std::vector<BenchmarkResult>& results, std::mutex& resultsMutex)
+void benchmarkWorkerHeuristic(ThreadSafeQueue& taskQueue, std::vector<BenchmarkResult>& results, std::mutex& resultsMutex,
+                              const bool recordRSS)
 {
     unsigned int n;
     while(taskQueue.pop(n))
@@ -570,14 +1223,22 @@ void benchmarkWorkerHeuristic(ThreadSafeQueue& taskQueue, std::vector<BenchmarkR
         std::vector<Item*> bin;
         float capacity = static_cast<float>(n) * 0.5f;
 
+        unsigned long baselineRSS = 0;
+        if (recordRSS)
+        {
+            resetPeakRSS();
+            baselineRSS = getCurrentRSS();
+        }
+
         auto start = std::chrono::high_resolution_clock::now();
         knapSackHeuristic(items, capacity, n, bin);
         auto end = std::chrono::high_resolution_clock::now();
+        unsigned long peakRSS = recordRSS ? getPeakRSSAbove(baselineRSS) : 0;
 
         float runtime = std::chrono::duration<float, std::milli>(end - start).count();
         {
             std::lock_guard<std::mutex> lock(resultsMutex);
-            results.push_back({n, runtime});
+            results.push_back({n, runtime, peakRSS});
         }
 
         delete[] items;
@@ -585,11 +1246,105 @@ void benchmarkWorkerHeuristic(ThreadSafeQueue& taskQueue, std::vector<BenchmarkR
     }
 }
 
+// Preconditions:
+//   1.) Valid Queue, Results Vector, And Mutex References
+//   2.) Only Worker Running So Peak RSS Belongs To This Run
+// Postconditions:
+//   1.) Processes Benchmark Tasks For Linear-Memory DP Algorithm
+//   2.) Updates Results Vector With Runtime And Peak RSS Growth Data
+//   3.) Thread-Safe Operation Maintained
+void benchmarkWorkerDP(ThreadSafeQueue& taskQueue, std::vector<BenchmarkResult>& results, std::mutex& resultsMutex)
+{
+    unsigned int n;
+    while(taskQueue.pop(n))
+    {
+        std::cout << "- DP:   Current n Size Of n = " << n << std::endl;
+        Item* items = new Item[n];
+        for(unsigned int i = 0; i < n; i++)
+        {
+            items[i] =
+            {
+                static_cast<float>(i + 1),
+                static_cast<float>((i + 1) * 10),
+                "Item" + std::to_string(i)
+            };
+        }
+
+        // Capacity Grows With n So The O(capacity) Profiles Reach Megabytes
+        std::vector<Item*> bin;
+        float capacity = static_cast<float>(n) * 10.0f;
+
+        resetPeakRSS();
+        unsigned long baselineRSS = getCurrentRSS();
+        auto start = std::chrono::high_resolution_clock::now();
+        knapSackDP(items, capacity, n, bin);
+        auto end = std::chrono::high_resolution_clock::now();
+        unsigned long peakRSS = getPeakRSSAbove(baselineRSS);
+
+        float runtime = std::chrono::duration<float, std::milli>(end - start).count();
+        {
+            std::lock_guard<std::mutex> lock(resultsMutex);
+            results.push_back({n, runtime, peakRSS});
+        }
+
+        delete[] items;
+        std::cout << "- DP:   END OF Current n Size Of n = " << n << std::endl;
+    }
+}
+
+// Preconditions:
+//   1.) Valid Queue, Results Vector, And Mutex References
+//   2.) Only Worker Running So Peak RSS Belongs To This Run
+// Postconditions:
+//   1.) Processes Benchmark Tasks For Gray-Code Exhaustive Algorithm
+//   2.) Updates Results Vector With Runtime And Peak RSS Growth Data
+//   3.) Thread-Safe Operation Maintained
+void benchmarkWorkerGray(ThreadSafeQueue& taskQueue, std::vector<BenchmarkResult>& results, std::mutex& resultsMutex)
+{
+    unsigned int n;
+    while(taskQueue.pop(n))
+    {
+        std::cout << "- GRAY CODE:   Current n Size Of n = " << n << std::endl;
+        Item* items = new Item[n];
+        for(unsigned int i = 0; i < n; i++)
+        {
+            items[i] =
+            {
+                static_cast<float>(i + 1),
+                static_cast<float>((i + 1) * 10),
+                "Item" + std::to_string(i)
+            };
+        }
+
+        std::vector<Item*> bin;
+        float capacity = static_cast<float>(n) * 0.5f;
+
+        resetPeakRSS();
+        unsigned long baselineRSS = getCurrentRSS();
+        auto start = std::chrono::high_resolution_clock::now();
+        knapSackGray(items, capacity, n, bin);
+        auto end = std::chrono::high_resolution_clock::now();
+        unsigned long peakRSS = getPeakRSSAbove(baselineRSS);
+
+        float runtime = std::chrono::duration<float, std::milli>(end - start).count();
+        {
+            std::lock_guard<std::mutex> lock(resultsMutex);
+            results.push_back({n, runtime, peakRSS});
+        }
+
+        delete[] items;
+        std::cout << "- GRAY CODE:   END OF Current n Size Of n = " << n << std::endl;
+    }
+}
+
+// Preconditions:
+//   1.) recordRSS Runs A Single Worker So Each Peak RSS Sample Belongs To One Run
 // Postconditions:
 //   1.) Generates JSON File With Benchmark Results
-//   2.) Multi-Threaded Execution Complete
+//   2.) Multi-Threaded Execution Complete Unless recordRSS
 //   3.) Results Sorted By Input Size
-void testBenchmark() {
+//   4.) Entries Hold "rss" Only If recordRSS
+void testBenchmark(const bool recordRSS = false) {
     ThreadSafeQueue taskQueue;
     std::vector<BenchmarkResult> results;
     std::mutex resultsMutex;
@@ -602,8 +1357,9 @@ void testBenchmark() {
 
     // Create thread pool
     std::vector<std::thread> threads;
-    for(int i = 0; i < MAX_THREADS; i++) {
-        threads.emplace_back(benchmarkWorker, std::ref(taskQueue),  std::ref(results), std::ref(resultsMutex));
+    const int threadCount = recordRSS ? 1 : MAX_THREADS;
+    for(int i = 0; i < threadCount; i++) {
+        threads.emplace_back(benchmarkWorker, std::ref(taskQueue),  std::ref(results), std::ref(resultsMutex), recordRSS);
     }
 
     // Wait for all threads to complete
@@ -624,7 +1380,9 @@ void testBenchmark() {
     for(size_t i = 0; i < results.size(); i++) {
         jsonFile << "        \"Test " << results[i].n << "\": {\n";
         jsonFile << "            \"n\": " << results[i].n << ",\n";
-        jsonFile << "            \"y\": " << results[i].runtime << "\n";
+        jsonFile << "            \"y\": " << results[i].runtime;
+        if(recordRSS) jsonFile << ",\n            \"rss\": " << results[i].peakRSS;
+        jsonFile << "\n";
         jsonFile << "        }";
         if(i < results.size() - 1) jsonFile << ",";
         jsonFile << "\n";
@@ -635,11 +1393,14 @@ void testBenchmark() {
 
 }
 
+// Preconditions:
+//   1.) recordRSS Runs A Single Worker So Each Peak RSS Sample Belongs To One Run
 // Postconditions:
 //   1.) Generates JSON File With Heuristic Benchmark Results
-//   2.) Multi-Threaded Execution Complete
+//   2.) Multi-Threaded Execution Complete Unless recordRSS
 //   3.) Results Sorted By Input Size
-void testBenchmarkHeuristic() {
+//   4.) Entries Hold "rss" Only If recordRSS
+void testBenchmarkHeuristic(const bool recordRSS = false) {
     ThreadSafeQueue taskQueue;
     std::vector<BenchmarkResult> results;
     std::mutex resultsMutex;
@@ -651,8 +1412,9 @@ void testBenchmarkHeuristic() {
 
     // Create thread pool
     std::vector<std::thread> threads;
-    for(int i = 0; i < MAX_THREADS; i++) {
-        threads.emplace_back(benchmarkWorkerHeuristic, std::ref(taskQueue),  std::ref(results), std::ref(resultsMutex));
+    const int threadCount = recordRSS ? 1 : MAX_THREADS;
+    for(int i = 0; i < threadCount; i++) {
+        threads.emplace_back(benchmarkWorkerHeuristic, std::ref(taskQueue),  std::ref(results), std::ref(resultsMutex), recordRSS);
     }
 
     // Wait for all threads to complete
@@ -673,7 +1435,96 @@ void testBenchmarkHeuristic() {
     for(size_t i = 0; i < results.size(); i++) {
         jsonFile << "        \"Test " << results[i].n << "\": {\n";
         jsonFile << "            \"n\": " << results[i].n << ",\n";
-        jsonFile << "            \"y\": " << results[i].runtime << "\n";
+        jsonFile << "            \"y\": " << results[i].runtime;
+        if(recordRSS) jsonFile << ",\n            \"rss\": " << results[i].peakRSS;
+        jsonFile << "\n";
+        jsonFile << "        }";
+        if(i < results.size() - 1) jsonFile << ",";
+        jsonFile << "\n";
+    }
+
+    jsonFile << "    }\n}";
+    jsonFile.close();
+
+}
+
+// Postconditions:
+//   1.) Generates JSON File With Linear-Memory DP Benchmark Results
+//   2.) Single-Threaded Execution Complete For Isolated Peak RSS
+//   3.) Results Sorted By Input Size
+void testBenchmarkDP() {
+    ThreadSafeQueue taskQueue;
+    std::vector<BenchmarkResult> results;
+    std::mutex resultsMutex;
+
+    // Fill queue with tasks, capacity Is 10n So Profiles Span 0.8 MB -> 8 MB
+    for(unsigned int n = 500; n <= 5000; n += 500) {
+        taskQueue.push(n);
+    }
+
+    // Single worker so each peak RSS sample belongs to one run
+    std::thread worker(benchmarkWorkerDP, std::ref(taskQueue),  std::ref(results), std::ref(resultsMutex));
+    worker.join();
+
+    // Sort results by n
+    std::sort(results.begin(), results.end(),
+              [](const BenchmarkResult& a, const BenchmarkResult& b) {
+                  return a.n < b.n;
+              });
+
+    // Write results to JSON
+    std::ofstream jsonFile("benchmark_results_dp.json");
+    jsonFile << "{\n    \"Benchmark Results\": {\n";
+
+    for(size_t i = 0; i < results.size(); i++) {
+        jsonFile << "        \"Test " << results[i].n << "\": {\n";
+        jsonFile << "            \"n\": " << results[i].n << ",\n";
+        jsonFile << "            \"y\": " << results[i].runtime << ",\n";
+        jsonFile << "            \"rss\": " << results[i].peakRSS << "\n";
+        jsonFile << "        }";
+        if(i < results.size() - 1) jsonFile << ",";
+        jsonFile << "\n";
+    }
+
+    jsonFile << "    }\n}";
+    jsonFile.close();
+
+}
+
+// Postconditions:
+//   1.) Generates JSON File With Gray-Code Exhaustive Benchmark Results
+//   2.) Each Run Gets Every Thread To Itself
+//   3.) Results Sorted By Input Size
+void testBenchmarkGray() {
+    ThreadSafeQueue taskQueue;
+    std::vector<BenchmarkResult> results;
+    std::mutex resultsMutex;
+
+    // Fill queue with tasks
+    // Every Extra Item Doubles The Work, So Stop Around n = 40
+    for(unsigned int n = 2; n <= 40; n += 2) {
+        taskQueue.push(n);
+    }
+
+    // Single worker as knapSackGray() already splits each run across threads
+    std::thread worker(benchmarkWorkerGray, std::ref(taskQueue),  std::ref(results), std::ref(resultsMutex));
+    worker.join();
+
+    // Sort results by n
+    std::sort(results.begin(), results.end(),
+              [](const BenchmarkResult& a, const BenchmarkResult& b) {
+                  return a.n < b.n;
+              });
+
+    // Write results to JSON
+    std::ofstream jsonFile("benchmark_results_gray.json");
+    jsonFile << "{\n    \"Benchmark Results\": {\n";
+
+    for(size_t i = 0; i < results.size(); i++) {
+        jsonFile << "        \"Test " << results[i].n << "\": {\n";
+        jsonFile << "            \"n\": " << results[i].n << ",\n";
+        jsonFile << "            \"y\": " << results[i].runtime << ",\n";
+        jsonFile << "            \"rss\": " << results[i].peakRSS << "\n";
         jsonFile << "        }";
         if(i < results.size() - 1) jsonFile << ",";
         jsonFile << "\n";
@@ -691,5 +1542,5 @@ int main()
     testUnit();
     testUnitHeuristic();
 
-    return 0;
+    return testUnitExact() ? 0 : 1;
 }